@@ -15,4 +15,42 @@ global _get_EFLAGS
 _get_EFLAGS:
 	pushfd			; push eflags
 	pop	eax		; pop contents into eax
-	ret
\ No newline at end of file
+	ret
+
+; ----------------------------------------------------------------------
+; port_read_words(port, buffer, n_words)
+;
+; Reads n_words 16-bit words from the given I/O port into the buffer,
+; with a single "rep insw".
+;
+; ----------------------------------------------------------------------
+global _port_read_words
+; this function is exported.
+_port_read_words:
+	push	edi		; callee-saved
+	mov	edx, [esp+8]	; port
+	mov	edi, [esp+12]	; buffer
+	mov	ecx, [esp+16]	; n_words
+	cld
+	rep insw
+	pop	edi
+	ret
+
+; ----------------------------------------------------------------------
+; port_write_words(port, buffer, n_words)
+;
+; Writes n_words 16-bit words from the buffer to the given I/O port,
+; with a single "rep outsw".
+;
+; ----------------------------------------------------------------------
+global _port_write_words
+; this function is exported.
+_port_write_words:
+	push	esi		; callee-saved
+	mov	edx, [esp+8]	; port
+	mov	esi, [esp+12]	; buffer
+	mov	ecx, [esp+16]	; n_words
+	cld
+	rep outsw
+	pop	esi
+	ret